@@ -9,6 +9,7 @@ class CfgFunctions {
             PATHTO_FNC(debug);
             PATHTO_FNC(error);
             PATHTO_FNC(log);
+            PATHTO_FNC(setLogLevel);
             PATHTO_FNC(test);
         };
         class ProjectileTracking {
@@ -1,3 +1,6 @@
+PREP(flushLog);
+PREP(getPerformanceStats);
 PREP(projectileTracking_drawProjectilePaths);
 PREP(projectileTracking_handleFired);
 PREP(projectileTracking_trackProjectile);
+PREP(updatePerformancePanel);
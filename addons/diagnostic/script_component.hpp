@@ -21,6 +21,7 @@
 
 #define IDC_DEBUGCONSOLE_PREV 90110
 #define IDC_DEBUGCONSOLE_NEXT 90111
+#define IDC_DEBUGCONSOLE_PERFORMANCE 90112
 
 #define ASCII_TAB 9
 #define ASCII_SPACE 32
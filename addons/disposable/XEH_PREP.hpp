@@ -1,2 +1,3 @@
 PREP(replaceMagazineCargo);
 PREP(changeDisposableLauncherClass);
+PREP(handlePendingDrops);
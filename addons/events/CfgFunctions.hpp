@@ -20,6 +20,8 @@ class CfgFunctions {
             PATHTO_FNC(globalEvent);
             PATHTO_FNC(globalEventJIP);
             PATHTO_FNC(removeGlobalEventJIP);
+            PATHTO_FNC(addObjectCleanup);
+            PATHTO_FNC(removeObjectCleanup);
             PATHTO_FNC(serverEvent);
             PATHTO_FNC(remoteEvent);
             PATHTO_FNC(targetEvent);
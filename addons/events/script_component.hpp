@@ -35,13 +35,41 @@
 #define TUEVENT_PVAR CBAv
 #define TUEVENT_PVAR_STR QUOTE(TUEVENT_PVAR)
 
+// turret owner cache for CBA_fnc_turretEvent, [client id, unit] published on the vehicle by the player in the turret
+#define TURRET_OWNER_VAR(turret) (QGVAR(turretOwner) + str (turret))
+
 #define SEND_TUEVENT_TO_SERVER(params,name,vehicle,turret) TUEVENT_PVAR = [name, params, vehicle, turret]; publicVariableServer TUEVENT_PVAR_STR
 
+// handlers added with CBA_fnc_addEventHandlerArgs are stored as [_thisArgs, _thisFnc, _thisType, _thisId]
 #define CALL_EVENT(args,event) {\
-    if !(isNil "_x") then {\
+    if (_x isEqualType {}) then {\
         args call _x;\
+    } else {\
+        if (_x isEqualType []) then {\
+            _x params ["_thisArgs", "_thisFnc", "_thisType", "_thisId"];\
+            args call _thisFnc;\
+        };\
+    };\
+} forEach (([GVAR(eventNamespace) getVariable event] param [0, []]) + []) // shallow copy so events can be removed while iterating safely
+
+// registration shared by CBA_fnc_addEventHandler and CBA_fnc_addEventHandlerArgs, defines _eventId
+#define REGISTER_EVENT_HANDLER(name,data) \
+    private _events = GVAR(eventNamespace) getVariable name;\
+    private _eventHash = GVAR(eventHashes) getVariable name;\
+    if (isNil "_events") then {\
+        _events = [];\
+        GVAR(eventNamespace) setVariable [name, _events];\
+        _eventHash = [[], -1] call CBA_fnc_hashCreate;\
+        GVAR(eventHashes) setVariable [name, _eventHash];\
     };\
-} forEach +([GVAR(eventNamespace) getVariable event] param [0, []]) // copy array so events can be removed while iterating safely
+    private _internalId = _events pushBack (data);\
+    private _eventId = [_eventHash, "#lastId"] call CBA_fnc_hashGet;\
+    INC(_eventId);\
+    [_eventHash, "#lastId", _eventId] call CBA_fnc_hashSet;\
+    [_eventHash, _eventId, _internalId] call CBA_fnc_hashSet
+
+// marker event fallback, see CBA_fnc_addMarkerEventHandler
+#define MARKER_POLLING_INTERVAL 0.5
 
 #define GETOBJ(obj) (if (obj isEqualType grpNull) then {leader obj} else {obj})
 
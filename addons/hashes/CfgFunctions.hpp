@@ -12,6 +12,15 @@ class CfgFunctions {
             PATHTO_FNC(hashSize);
             PATHTO_FNC(hashValues);
             PATHTO_FNC(isHash);
+            PATHTO_FNC(sortedMapCreate);
+            PATHTO_FNC(sortedMapFind);
+            PATHTO_FNC(sortedMapGet);
+            PATHTO_FNC(sortedMapSet);
+            PATHTO_FNC(sortedMapRem);
+            PATHTO_FNC(sortedMapFloor);
+            PATHTO_FNC(sortedMapCeiling);
+            PATHTO_FNC(sortedMapRange);
+            PATHTO_FNC(isSortedMap);
             PATHTO_FNC(parseYAML);
             PATHTO_FNC(serializeNamespace);
             PATHTO_FNC(deserializeNamespace);
@@ -4,3 +4,9 @@
 #define HASH_DEFAULT_VALUE 3
 
 #define TYPE_HASH "#CBA_HASH#"
+
+#define SORTED_MAP_ID 0
+#define SORTED_MAP_KEYS 1
+#define SORTED_MAP_VALUES 2
+
+#define TYPE_SORTED_MAP "#CBA_SORTED_MAP#"
@@ -3,6 +3,9 @@ class CfgFunctions {
         class Loadout {
             PATHTO_FNC(getLoadout);
             PATHTO_FNC(setLoadout);
+            PATHTO_FNC(diffLoadout);
+            PATHTO_FNC(encodeLoadout);
+            PATHTO_FNC(decodeLoadout);
         };
     };
 };
@@ -10,3 +10,6 @@
 #endif
 
 #include "\x\cba\addons\main\script_macros.hpp"
+
+// getUnitLoadout entries CBA_fnc_setLoadout can change without applying the whole loadout: headgear, facewear, assigned items
+#define DELTA_SLOTS [6, 7, 9]
@@ -122,6 +122,9 @@ Macros: DEBUG_MODE_x
     DEBUG_MODE_FULL - Full debugging output.
     DEBUG_MODE_NORMAL - All debugging except <TRACE_n()> and <LOG()> (Default setting if none specified).
     DEBUG_MODE_MINIMAL - Only <ERROR()> and <ERROR_WITH_TITLE()> enabled.
+    DEBUG_MODE_RUNTIME - Compile <TRACE_n()> and <LOG()> in, but only run them if the runtime log level of the
+                         component allows it (see <LOG_LEVEL_ENABLED()>). The level is checked before any formatting.
+                         Has no effect if DEBUG_MODE_FULL is defined.
 
 Examples:
     In order to turn on full debugging for a single file,
@@ -186,11 +189,50 @@ Author:
 
 #define LOG_SYS_FILELINENUMBERS(LEVEL,MESSAGE) LOG_SYS(LEVEL,format [ARR_4('%1 %2:%3',MESSAGE,__FILE__,__LINE__ + 1)])
 
+/* -------------------------------------------
+Macros: LOG_LEVEL_x
+    Runtime log levels used by <DEBUG_MODE_RUNTIME>.
+
+    Only <LOG()> and <TRACE_n()> are switchable at runtime. <INFO()>, <WARNING()> and <ERROR()>
+    are not affected by the log level. Any level below LOG_LEVEL_DEBUG disables both.
+
+    LOG_LEVEL_DEBUG - 4, enables <LOG()>.
+    LOG_LEVEL_TRACE - 5, enables <LOG()> and <TRACE_n()>.
+
+Author:
+    CBA Team
+------------------------------------------- */
+#define LOG_LEVEL_DEBUG 4
+#define LOG_LEVEL_TRACE 5
+
+/* -------------------------------------------
+Macro: LOG_LEVEL_ENABLED()
+    Check if messages of the given level are enabled for the current component at runtime.
+
+    The threshold is set per component with <CBA_fnc_setLogLevel>. The entry "*" is used for components
+    without their own threshold. Always false if no threshold was ever set.
+
+Parameters:
+    LEVEL - Log level, see <LOG_LEVEL_x> <NUMBER>
+
+Example:
+    (begin example)
+        if (LOG_LEVEL_ENABLED(LOG_LEVEL_DEBUG)) then {
+            diag_log text str _expensiveState;
+        };
+    (end)
+
+Author:
+    CBA Team
+------------------------------------------- */
+#define LOG_LEVEL_ENABLED(LEVEL) (!isNil 'CBA_diagnostic_logLevels' && {(CBA_diagnostic_logLevels getOrDefault [QUOTE(ADDON), CBA_diagnostic_logLevels getOrDefault ['*', 0]]) >= LEVEL})
+
 /* -------------------------------------------
 Macro: LOG()
     Log a debug message into the RPT log.
 
-    Only run if <DEBUG_MODE_FULL> is defined.
+    Only run if <DEBUG_MODE_FULL> is defined, or if <DEBUG_MODE_RUNTIME> is defined and
+    the component's log level is at least LOG_LEVEL_DEBUG.
 
 Parameters:
     MESSAGE - Message to record <STRING>
@@ -215,6 +257,19 @@ Author:
 #define LOG_7(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6,ARG7) LOG(FORMAT_7(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6,ARG7))
 #define LOG_8(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6,ARG7,ARG8) LOG(FORMAT_8(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6,ARG7,ARG8))
 
+#else
+#ifdef DEBUG_MODE_RUNTIME
+
+#define LOG(MESSAGE) if (LOG_LEVEL_ENABLED(LOG_LEVEL_DEBUG)) then {LOG_SYS('LOG',MESSAGE)}
+#define LOG_1(MESSAGE,ARG1) LOG(FORMAT_1(MESSAGE,ARG1))
+#define LOG_2(MESSAGE,ARG1,ARG2) LOG(FORMAT_2(MESSAGE,ARG1,ARG2))
+#define LOG_3(MESSAGE,ARG1,ARG2,ARG3) LOG(FORMAT_3(MESSAGE,ARG1,ARG2,ARG3))
+#define LOG_4(MESSAGE,ARG1,ARG2,ARG3,ARG4) LOG(FORMAT_4(MESSAGE,ARG1,ARG2,ARG3,ARG4))
+#define LOG_5(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5) LOG(FORMAT_5(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5))
+#define LOG_6(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6) LOG(FORMAT_6(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6))
+#define LOG_7(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6,ARG7) LOG(FORMAT_7(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6,ARG7))
+#define LOG_8(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6,ARG7,ARG8) LOG(FORMAT_8(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6,ARG7,ARG8))
+
 #else
 
 #define LOG(MESSAGE) /* disabled */
@@ -227,6 +282,7 @@ Author:
 #define LOG_7(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6,ARG7) /* disabled */
 #define LOG_8(MESSAGE,ARG1,ARG2,ARG3,ARG4,ARG5,ARG6,ARG7,ARG8) /* disabled */
 
+#endif
 #endif
 
 /* -------------------------------------------
@@ -440,7 +496,8 @@ Author:
 Macros: TRACE_n()
     Log a message and 1-8 variables to the RPT log.
 
-    Only run if <DEBUG_MODE_FULL> is defined.
+    Only run if <DEBUG_MODE_FULL> is defined, or if <DEBUG_MODE_RUNTIME> is defined and
+    the component's log level is at least LOG_LEVEL_TRACE.
 
     TRACE_1(MESSAGE,A) - Log 1 variable.
     TRACE_2(MESSAGE,A,B) - Log 2 variables.
@@ -503,6 +560,17 @@ Author:
 #define TRACE_8(MESSAGE,A,B,C,D,E,F,G,H) LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_8(str diag_frameNo + ' ' + (MESSAGE),A,B,C,D,E,F,G,H))
 #define TRACE_9(MESSAGE,A,B,C,D,E,F,G,H,I) LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_9(str diag_frameNo + ' ' + (MESSAGE),A,B,C,D,E,F,G,H,I))
 #else
+#ifdef DEBUG_MODE_RUNTIME
+#define TRACE_1(MESSAGE,A) if (LOG_LEVEL_ENABLED(LOG_LEVEL_TRACE)) then {LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_1(str diag_frameNo + ' ' + (MESSAGE),A))}
+#define TRACE_2(MESSAGE,A,B) if (LOG_LEVEL_ENABLED(LOG_LEVEL_TRACE)) then {LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_2(str diag_frameNo + ' ' + (MESSAGE),A,B))}
+#define TRACE_3(MESSAGE,A,B,C) if (LOG_LEVEL_ENABLED(LOG_LEVEL_TRACE)) then {LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_3(str diag_frameNo + ' ' + (MESSAGE),A,B,C))}
+#define TRACE_4(MESSAGE,A,B,C,D) if (LOG_LEVEL_ENABLED(LOG_LEVEL_TRACE)) then {LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_4(str diag_frameNo + ' ' + (MESSAGE),A,B,C,D))}
+#define TRACE_5(MESSAGE,A,B,C,D,E) if (LOG_LEVEL_ENABLED(LOG_LEVEL_TRACE)) then {LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_5(str diag_frameNo + ' ' + (MESSAGE),A,B,C,D,E))}
+#define TRACE_6(MESSAGE,A,B,C,D,E,F) if (LOG_LEVEL_ENABLED(LOG_LEVEL_TRACE)) then {LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_6(str diag_frameNo + ' ' + (MESSAGE),A,B,C,D,E,F))}
+#define TRACE_7(MESSAGE,A,B,C,D,E,F,G) if (LOG_LEVEL_ENABLED(LOG_LEVEL_TRACE)) then {LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_7(str diag_frameNo + ' ' + (MESSAGE),A,B,C,D,E,F,G))}
+#define TRACE_8(MESSAGE,A,B,C,D,E,F,G,H) if (LOG_LEVEL_ENABLED(LOG_LEVEL_TRACE)) then {LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_8(str diag_frameNo + ' ' + (MESSAGE),A,B,C,D,E,F,G,H))}
+#define TRACE_9(MESSAGE,A,B,C,D,E,F,G,H,I) if (LOG_LEVEL_ENABLED(LOG_LEVEL_TRACE)) then {LOG_SYS_FILELINENUMBERS('TRACE',PFORMAT_9(str diag_frameNo + ' ' + (MESSAGE),A,B,C,D,E,F,G,H,I))}
+#else
 #define TRACE_1(MESSAGE,A) /* disabled */
 #define TRACE_2(MESSAGE,A,B) /* disabled */
 #define TRACE_3(MESSAGE,A,B,C) /* disabled */
@@ -513,6 +581,7 @@ Author:
 #define TRACE_8(MESSAGE,A,B,C,D,E,F,G,H) /* disabled */
 #define TRACE_9(MESSAGE,A,B,C,D,E,F,G,H,I) /* disabled */
 #endif
+#endif
 
 /* -------------------------------------------
 Group: General
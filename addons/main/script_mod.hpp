@@ -19,6 +19,9 @@
 #endif
 */
 
+// Compile LOG and TRACE in, but only run them for components enabled with CBA_fnc_setLogLevel
+// #define DEBUG_MODE_RUNTIME
+
 // Set a default debug mode for the component here (See documentation on how to default to each of the modes).
 /*
     #define DEBUG_ENABLED_COMMON
@@ -5,6 +5,7 @@ class CfgFunctions {
             PATHTO_FNC(getMusicData);
             PATHTO_FNC(findMusic);
             PATHTO_FNC(compileMusic);
+            PATHTO_FNC(getMusicIndex);
             PATHTO_FNC(getMusicPlaying);
             PATHTO_FNC(isMusicPlaying);
             PATHTO_FNC(playMusic);
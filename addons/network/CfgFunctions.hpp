@@ -2,6 +2,8 @@ class CfgFunctions {
     class CBA {
         class Network {
             PATHTO_FNC(globalExecute);
+            PATHTO_FNC(addRemoteFunction);
+            PATHTO_FNC(remoteExecute);
             PATHTO_FNC(globalSay);
             PATHTO_FNC(globalSay3d);
             PATHTO_FNC(publicVariable);
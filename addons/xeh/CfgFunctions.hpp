@@ -7,8 +7,13 @@ class CfgFunctions {
             PATHTO_FNC(init);
             PATHTO_FNC(initEvents);
             PATHTO_FNC(supportMonitor);
+            PATHTO_FNC(addConfigScan);
+            PATHTO_FNC(getConfigScan);
+            PATHTO_FNC(runConfigScan);
             PATHTO_FNC(compileEventHandlers);
             PATHTO_FNC(compileFunction);
+            PATHTO_FNC(compileLazyFunction);
+            PATHTO_FNC(unusedFunctions);
             PATHTO_FNC(startFallbackLoop);
 
             class preStart {
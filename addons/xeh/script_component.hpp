@@ -34,7 +34,10 @@
 
 #define XEH_FORMAT_CONFIG_NAME(name) format ["Extended_%1_EventHandlers", name]
 
-#define ISKINDOF(object,classname,allowInherit,excluded) ((allowInherit || {typeOf object == classname}) && {{object isKindOf _x} count (excluded) == 0})
+#define ISKINDOF(type,classname,allowInherit,excluded) ((allowInherit || {type == classname}) && {{type isKindOf _x} count (excluded) == 0})
+
+// Event handler entry: [function, allowInherit, excluded, HashMap: object type -> ISKINDOF result]. Excluded classes are only checked once per object type.
+#define ISKINDOF_CACHED(type,classname,entry) ((entry select 3) getOrDefaultCall [type, {ISKINDOF(type,classname,entry select 1,entry select 2)}, true])
 
 #include "script_xeh.hpp"
 
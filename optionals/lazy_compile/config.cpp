@@ -0,0 +1,23 @@
+#include "script_component.hpp"
+
+class CfgPatches {
+    class ADDON {
+        author = "$STR_CBA_Author";
+        name = ECSTRING(Optional,Component);
+        url = "$STR_CBA_URL";
+        units[] = {};
+        weapons[] = {};
+        requiredVersion = REQUIRED_VERSION;
+        requiredAddons[] = {"CBA_Extended_EventHandlers", "CBA_Main"};
+        version = VERSION;
+        authors[] = {"CBA Team"};
+    };
+};
+
+class CfgSettings {
+    class CBA {
+        class Caching {
+            lazy = 1;
+        };
+    };
+};
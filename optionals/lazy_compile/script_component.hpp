@@ -0,0 +1,16 @@
+#define COMPONENT lazy_compile
+#include "\x\cba\addons\main\script_mod.hpp"
+
+
+#ifdef DEBUG_ENABLED_LAZY_COMPILE
+    #define DEBUG_MODE_FULL
+#endif
+
+#ifdef DEBUG_SETTINGS_LAZY_COMPILE
+    #define DEBUG_SETTINGS DEBUG_SETTINGS_LAZY_COMPILE
+#endif
+
+#undef REQUIRED_VERSION
+#define REQUIRED_VERSION 1.00
+
+#include "\x\cba\addons\main\script_macros.hpp"